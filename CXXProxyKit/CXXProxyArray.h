@@ -41,12 +41,13 @@ typedef NSUInteger (^CXXArraySizeGetter)(void);
                                                                                         \
 - (ObjcElementType *)objectAtIndexedSubscript:(NSInteger)idx;
 
-#define CXX_ARRAY_BACKED_PROXY_OBJECT(ObjcType, ObjcElementType, CppType, IvarName)     \
+#define CXX_ARRAY_BACKED_PROXY_OBJECT_IMPL(ObjcType, ObjcElementType, CppType, IvarName, ProxyArrayExpr) \
 ObjcType (CXXDummyCategory) @end                                                        \
                                                                                         \
 @interface ObjcType () {                                                                \
     cxx::proxy_ptr<const CppType> IvarName;                                             \
     CXXNonOwningProxyArray *proxyArray;                                                 \
+    std::once_flag proxyArrayOnceFlag;                                                  \
 }                                                                                       \
                                                                                         \
 @end                                                                                    \
@@ -56,7 +57,6 @@ ObjcType (CXXDummyCategory) @end
 - (instancetype)initWithOwnedPtr:(const void *)ptr {                                    \
     if (self = [super init]) {                                                          \
         IvarName = cxx::make_proxy_ptr<CppType>(ptr, cxx::owning);                      \
-        proxyArray = cxx::make_non_owning_proxy_array(*IvarName, ObjcElementType.class);\
         if ([self respondsToSelector:@selector(implementationDidLoad)]) {               \
             [self implementationDidLoad];                                               \
         }                                                                               \
@@ -68,7 +68,6 @@ ObjcType (CXXDummyCategory) @end
 - (instancetype)initWithUnownedPtr:(const void *)ptr {                                  \
     if (self = [super init]) {                                                          \
         IvarName = cxx::make_proxy_ptr<CppType>(ptr, cxx::non_owning);                  \
-        proxyArray = cxx::make_non_owning_proxy_array(*IvarName, ObjcElementType.class);\
         if ([self respondsToSelector:@selector(implementationDidLoad)]) {               \
             [self implementationDidLoad];                                               \
         }                                                                               \
@@ -77,6 +76,14 @@ ObjcType (CXXDummyCategory) @end
     return self;                                                                        \
 }                                                                                       \
                                                                                         \
+- (CXXNonOwningProxyArray *)loadProxyArrayIfNeeded {                                    \
+    std::call_once(proxyArrayOnceFlag, [&] {                                            \
+        proxyArray = ProxyArrayExpr;                                                    \
+    });                                                                                 \
+                                                                                        \
+    return proxyArray;                                                                  \
+}                                                                                       \
+                                                                                        \
 - (const void *)implementationPtr {                                                     \
     return IvarName.get();                                                              \
 }                                                                                       \
@@ -85,20 +92,20 @@ ObjcType (CXXDummyCategory) @end
     return sizeof(CppType);                                                             \
 }                                                                                       \
                                                                                         \
-- (ObjcElementType *)objectAtIndexedSubscript:(NSInteger)idx {                          \
-    return proxyArray[idx];                                                             \
+- (ObjcElementType)objectAtIndexedSubscript:(NSInteger)idx {                            \
+    return [self loadProxyArrayIfNeeded][idx];                                          \
 }                                                                                       \
                                                                                         \
 - (NSInteger)count {                                                                    \
-    return proxyArray.count;                                                            \
+    return [self loadProxyArrayIfNeeded].count;                                         \
 }                                                                                       \
                                                                                         \
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state               \
                                   objects:(__unsafe_unretained id *)buffer              \
                                     count:(NSUInteger)bufferSize {                      \
-      return [proxyArray countByEnumeratingWithState:state                              \
-                                             objects:buffer                             \
-                                               count:bufferSize];                       \
+      return [[self loadProxyArrayIfNeeded] countByEnumeratingWithState:state           \
+                                                                objects:buffer          \
+                                                                  count:bufferSize];    \
 }                                                                                       \
                                                                                         \
 - (NSArray *)toArray {                                                                  \
@@ -110,6 +117,25 @@ ObjcType (CXXDummyCategory) @end
     return array;                                                                       \
 }
 
+/**
+ This macro must be called after the @implementation keyword of a CXXArrayBackedProxyObject subclass.
+
+ The backing proxy array is created on the first access to its elements or count.
+ */
+#define CXX_ARRAY_BACKED_PROXY_OBJECT(ObjcType, ObjcElementType, CppType, IvarName)     \
+CXX_ARRAY_BACKED_PROXY_OBJECT_IMPL(ObjcType, ObjcElementType *, CppType, IvarName,      \
+    cxx::make_non_owning_proxy_array(*IvarName, ObjcElementType.class))
+
+/**
+ This macro must be called after the @implementation keyword of a CXXArrayBackedProxyObject subclass
+ backed by a container of containers, e.g. std::vector<std::vector<T>>.
+
+ Its elements are instances of CXXNonOwningProxyArray for nested containers, and instances of LeafObjcElementType
+ for the elements of LeafCppType.
+ */
+#define CXX_NESTED_ARRAY_BACKED_PROXY_OBJECT(ObjcType, LeafObjcElementType, LeafCppType, CppType, IvarName) \
+CXX_ARRAY_BACKED_PROXY_OBJECT_IMPL(ObjcType, CXXNonOwningProxyArray *, CppType, IvarName,                   \
+    cxx::make_nested_non_owning_proxy_array<LeafCppType>(*IvarName, LeafObjcElementType.class))
 
 NS_ASSUME_NONNULL_END
 
@@ -118,8 +144,10 @@ NS_ASSUME_NONNULL_END
 #ifndef CXX_NON_OWNING_PROXY_ARRAY_H
 #define CXX_NON_OWNING_PROXY_ARRAY_H
 
+#include <mutex>
 #include <vector>
 #include <type_traits>
+#include <utility>
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -127,6 +155,8 @@ namespace cxx {
 
 /**
  Creates an instance of CXXNonOwningProxyArray from a generic C++ container using elementAllocator for creating proxy object.
+
+ The container is not copied, so it must outlive the returned array.
  */
 template <
     typename ContainerT,
@@ -134,30 +164,83 @@ template <
     typename ElementT = typename std::iterator_traits<typename ContainerT::const_iterator>::value_type,
     std::enable_if_t<std::is_invocable<ElementAllocatorT, ElementT>::value, int> = 0
 >
-auto make_non_owning_proxy_array(ContainerT container,
+auto make_non_owning_proxy_array(const ContainerT &container,
                                  ElementAllocatorT elementAllocator) -> CXXNonOwningProxyArray * {
+    const ContainerT *containerPtr = &container;
+
     auto itemProxyAllocator = ^(size_t index) {
-        const ElementT &element = *(container.begin() + index);
+        const ElementT &element = *(containerPtr->begin() + index);
         return elementAllocator(element);
     };
 
     return [[CXXNonOwningProxyArray alloc] initWithItemProxyAllocator:itemProxyAllocator
                                                         countingBlock:^size_t {
-        return container.end() - container.begin();
+        return containerPtr->end() - containerPtr->begin();
     }];
 }
 
 /**
  Creates an instance of CXXNonOwningProxyArray from a generic C++ container using ItemProxyClass for creating proxy object.
+
+ The container is not copied, so it must outlive the returned array.
  */
 template <typename ContainerT>
-auto make_non_owning_proxy_array(ContainerT container,
+auto make_non_owning_proxy_array(const ContainerT &container,
                                  Class<CXXProxyObject> ItemProxyClass) -> CXXNonOwningProxyArray * {
     return make_non_owning_proxy_array(container, [=] (const auto &element) {
         return [[(Class)ItemProxyClass alloc] initWithUnownedPtr:&element];
     });
 }
 
+/**
+ Non-owning proxy arrays can't be made from temporary containers.
+ */
+template <typename ContainerT, typename ElementProxyFactoryT>
+auto make_non_owning_proxy_array(const ContainerT &&container,
+                                 ElementProxyFactoryT elementProxyFactory) -> CXXNonOwningProxyArray * = delete;
+
+template <typename T, typename = void>
+struct is_container : std::false_type {};
+
+template <typename T>
+struct is_container<T, std::void_t<
+    typename T::const_iterator,
+    decltype(std::declval<const T &>().begin()),
+    decltype(std::declval<const T &>().end())
+>> : std::true_type {};
+
+template <typename T>
+constexpr const bool is_container_v = is_container<T>::value;
+
+/**
+ Creates an instance of CXXNonOwningProxyArray from a C++ container of containers, e.g. std::vector<std::vector<T>>.
+
+ Nested containers are represented by instances of CXXNonOwningProxyArray,
+ which are created on access and don't copy the nested container.
+ Elements of type LeafT are represented by instances of LeafProxyClass, even if LeafT is a container itself.
+ */
+template <
+    typename LeafT,
+    typename ContainerT,
+    typename ElementT = typename std::iterator_traits<typename ContainerT::const_iterator>::value_type
+>
+auto make_nested_non_owning_proxy_array(const ContainerT &container,
+                                        Class<CXXProxyObject> LeafProxyClass) -> CXXNonOwningProxyArray * {
+    if constexpr (std::is_same_v<ElementT, LeafT>) {
+        return make_non_owning_proxy_array(container, LeafProxyClass);
+    } else {
+        static_assert(is_container_v<ElementT>, "LeafT must be the element type of an innermost container");
+
+        return make_non_owning_proxy_array(container, [=] (const ElementT &element) {
+            return make_nested_non_owning_proxy_array<LeafT>(element, LeafProxyClass);
+        });
+    }
+}
+
+template <typename LeafT, typename ContainerT>
+auto make_nested_non_owning_proxy_array(const ContainerT &&container,
+                                        Class<CXXProxyObject> LeafProxyClass) -> CXXNonOwningProxyArray * = delete;
+
 }
 
 NS_ASSUME_NONNULL_END
@@ -17,4 +17,5 @@ FOUNDATION_EXPORT const unsigned char CXXProxyKitVersionString[];
 #import <CXXProxyKit/CXXProxyPtr.h>
 #import <CXXProxyKit/CXXProxyObject.h>
 #import <CXXProxyKit/CXXProxyArray.h>
+#import <CXXProxyKit/CXXProxyStream.h>
 
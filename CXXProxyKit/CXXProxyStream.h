@@ -0,0 +1,133 @@
+//
+//  CXXProxyStream.h
+//  CXXProxyKit
+//
+//  Created by Dmitry Khrykin on 22.09.2020.
+//  Copyright © 2020 Dmitry Khrykin. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <CXXProxyKit/CXXProxyObject.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Returns a proxy for the next element of a stream, or nil if the stream is exhausted.
+ */
+typedef id _Nullable (^CXXStreamElementProxyProducer)(void);
+
+/**
+ A single-pass sequence of proxy objects that are produced one by one, without knowing the number of elements up front.
+
+ Enumeration fills fast enumeration buffers in chunks and consumes the stream:
+ enumerating it again continues from where the previous enumeration has stopped.
+ */
+@interface CXXProxyStream<T> : NSObject <NSFastEnumeration>
+
+/**
+ Initializes a stream that calls producer on the enumerating thread.
+ */
+- (instancetype)initWithElementProxyProducer:(CXXStreamElementProxyProducer)producer;
+
+/**
+ Initializes a stream that calls producer on a background thread, staying at most prefetchCapacity elements
+ ahead of the consumer. Passing 0 disables prefetching.
+
+ A C++ exception thrown by the producer is rethrown on the consuming thread after the elements produced before it.
+
+ Prefetching starts on the first request of an element. The producer must not reference any state
+ that may be destroyed before it returns nil, since it can outlive the stream for one call.
+ */
+- (instancetype)initWithElementProxyProducer:(CXXStreamElementProxyProducer)producer
+                            prefetchCapacity:(NSUInteger)prefetchCapacity;
+
+/**
+ Returns the next element of the stream, or nil if the stream is exhausted.
+ */
+- (nullable T)nextObject;
+
+/**
+ Consumes the rest of the stream into an array.
+ */
+- (NSArray<T> *)toArray;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#ifdef __cplusplus
+
+#ifndef CXX_PROXY_STREAM_H
+#define CXX_PROXY_STREAM_H
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+NS_ASSUME_NONNULL_BEGIN
+
+namespace cxx {
+
+template <typename GeneratorT>
+using generated_element_t = typename std::decay_t<std::invoke_result_t<GeneratorT &>>::value_type;
+
+/**
+ Creates an instance of StreamT from a C++ generator using elementAllocator for creating proxy object.
+
+ The generator is a callable returning std::optional of an element, where std::nullopt marks the end of the stream.
+ If prefetchCapacity is non-zero, the generator is run on a background thread.
+
+ StreamT can be a subclass of CXXProxyStream, e.g. one that conforms to CXXProxyArraySequence in Swift.
+ */
+template <
+    typename StreamT = CXXProxyStream,
+    typename GeneratorT,
+    typename ElementAllocatorT,
+    typename ElementT = generated_element_t<GeneratorT>,
+    std::enable_if_t<std::is_invocable<ElementAllocatorT, ElementT &&>::value, int> = 0
+>
+auto make_proxy_stream(GeneratorT generator,
+                       ElementAllocatorT elementAllocator,
+                       size_t prefetchCapacity = 0) -> StreamT * {
+    static_assert(std::is_convertible_v<StreamT *, CXXProxyStream *>, "StreamT must be a subclass of CXXProxyStream");
+
+    auto sharedGenerator = std::make_shared<GeneratorT>(std::move(generator));
+    auto elementProxyProducer = ^id _Nullable (void) {
+        auto element = (*sharedGenerator)();
+        if (!element) {
+            return nil;
+        }
+
+        return elementAllocator(std::move(*element));
+    };
+
+    return [[StreamT alloc] initWithElementProxyProducer:elementProxyProducer
+                                        prefetchCapacity:prefetchCapacity];
+}
+
+/**
+ Creates an instance of StreamT from a C++ generator using ItemProxyClass for creating proxy object.
+
+ Each proxy object takes ownership of a generated element.
+ */
+template <
+    typename StreamT = CXXProxyStream,
+    typename GeneratorT,
+    typename ElementT = generated_element_t<GeneratorT>
+>
+auto make_proxy_stream(GeneratorT generator,
+                       Class<CXXProxyObject> ItemProxyClass,
+                       size_t prefetchCapacity = 0) -> StreamT * {
+    return make_proxy_stream<StreamT>(std::move(generator), [=] (ElementT &&element) {
+        return [[(Class)ItemProxyClass alloc] initWithOwnedPtr:new ElementT(std::move(element))];
+    }, prefetchCapacity);
+}
+
+}
+
+NS_ASSUME_NONNULL_END
+
+#endif
+
+#endif
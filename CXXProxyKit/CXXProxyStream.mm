@@ -0,0 +1,256 @@
+//
+//  CXXProxyStream.mm
+//  CXXProxyKit
+//
+//  Created by Dmitry Khrykin on 22.09.2020.
+//  Copyright © 2020 Dmitry Khrykin. All rights reserved.
+//
+
+#import "CXXProxyStream.h"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ A bounded single-producer, single-consumer queue of proxy objects.
+ */
+class prefetch_ring_buffer {
+public:
+    explicit prefetch_ring_buffer(size_t capacity)
+    : slots(capacity) {}
+
+    /**
+     Blocks until there's a free slot. Returns false if the consumer has gone away.
+     */
+    bool push(id element) {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this] { return count < slots.size() || cancelled; });
+
+        if (cancelled) {
+            return false;
+        }
+
+        slots[(head + count) % slots.size()] = element;
+        count++;
+
+        not_empty.notify_one();
+
+        return true;
+    }
+
+    /**
+     Blocks until at least one element is available or the producer has finished,
+     then pops up to max_count elements at once.
+
+     Once all the elements are popped, rethrows the exception the producer has failed with, if any.
+     */
+    template <typename ConsumerT>
+    size_t pop(size_t max_count, ConsumerT consume) {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this] { return count > 0 || finished; });
+
+        if (count == 0 && error) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+
+        size_t popped_count = 0;
+        while (count > 0 && popped_count < max_count) {
+            consume(slots[head]);
+            slots[head] = nil;
+
+            head = (head + 1) % slots.size();
+            count--;
+            popped_count++;
+        }
+
+        not_full.notify_one();
+
+        return popped_count;
+    }
+
+    void finish(std::exception_ptr producer_error = nullptr) {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        error = producer_error;
+
+        not_empty.notify_all();
+    }
+
+    void cancel() {
+        std::lock_guard<std::mutex> lock(mutex);
+        cancelled = true;
+
+        not_full.notify_all();
+    }
+
+private:
+    std::vector<id> slots;
+    size_t head = 0;
+    size_t count = 0;
+
+    bool finished = false;
+    bool cancelled = false;
+    std::exception_ptr error;
+
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+};
+
+}
+
+@interface CXXProxyStream () {
+    CXXStreamElementProxyProducer _produceElementProxy;
+    NSUInteger _prefetchCapacity;
+    std::shared_ptr<prefetch_ring_buffer> _prefetchBuffer;
+    std::exception_ptr _producerError;
+    BOOL _exhausted;
+}
+
+@end
+
+@implementation CXXProxyStream
+
+- (instancetype)initWithElementProxyProducer:(CXXStreamElementProxyProducer)producer {
+    return [self initWithElementProxyProducer:producer prefetchCapacity:0];
+}
+
+- (instancetype)initWithElementProxyProducer:(CXXStreamElementProxyProducer)producer
+                            prefetchCapacity:(NSUInteger)prefetchCapacity {
+    if (self = [super init]) {
+        _produceElementProxy = producer;
+        _prefetchCapacity = prefetchCapacity;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    if (_prefetchBuffer) {
+        _prefetchBuffer->cancel();
+    }
+}
+
+- (void)startPrefetchingIfNeeded {
+    if (_prefetchBuffer) {
+        return;
+    }
+
+    auto buffer = std::make_shared<prefetch_ring_buffer>(_prefetchCapacity);
+    CXXStreamElementProxyProducer produceElementProxy = _produceElementProxy;
+
+    // The producer thread doesn't retain the stream, so that it can be deallocated
+    // while the thread is waiting for a free slot.
+    std::thread([buffer, produceElementProxy] {
+        try {
+            while (true) {
+                @autoreleasepool {
+                    id element = produceElementProxy();
+                    if (!element || !buffer->push(element)) {
+                        break;
+                    }
+                }
+            }
+        } catch (...) {
+            // Rethrown on the consuming thread after the prefetched elements.
+            buffer->finish(std::current_exception());
+            return;
+        }
+
+        buffer->finish();
+    }).detach();
+
+    _prefetchBuffer = buffer;
+}
+
+/**
+ Fills the buffer with up to bufferSize autoreleased elements, returns the number of elements provided.
+ */
+- (NSUInteger)fillBuffer:(__unsafe_unretained id _Nullable * _Nonnull)buffer
+                   count:(NSUInteger)bufferSize {
+    if (_producerError) {
+        _exhausted = YES;
+        std::rethrow_exception(std::exchange(_producerError, nullptr));
+    }
+
+    if (_exhausted) {
+        return 0;
+    }
+
+    NSUInteger indexInBuffer = 0;
+
+    if (_prefetchCapacity > 0) {
+        [self startPrefetchingIfNeeded];
+
+        _prefetchBuffer->pop(bufferSize, [&] (id element) {
+            buffer[indexInBuffer++] = (__bridge id)CFAutorelease(CFBridgingRetain(element));
+        });
+
+        _exhausted = indexInBuffer == 0;
+    } else {
+        while (indexInBuffer < bufferSize) {
+            id element = nil;
+
+            try {
+                element = _produceElementProxy();
+            } catch (...) {
+                // Provide the elements produced before the failure first, like the prefetching stream does.
+                _exhausted = YES;
+                if (indexInBuffer == 0) {
+                    throw;
+                }
+
+                _producerError = std::current_exception();
+                break;
+            }
+
+            if (!element) {
+                _exhausted = YES;
+                break;
+            }
+
+            buffer[indexInBuffer++] = (__bridge id)CFAutorelease(CFBridgingRetain(element));
+        }
+    }
+
+    return indexInBuffer;
+}
+
+- (id)nextObject {
+    __unsafe_unretained id element = nil;
+    [self fillBuffer:&element count:1];
+
+    return element;
+}
+
+- (NSUInteger)countByEnumeratingWithState:(nonnull NSFastEnumerationState *)state
+                                  objects:(__unsafe_unretained id _Nullable * _Nonnull)buffer
+                                    count:(NSUInteger)bufferSize {
+    // The stream is consumed by enumeration, so state->state only marks that
+    // the one-time setup has been done.
+    if (state->state == 0) {
+        state->mutationsPtr = &state->extra[0];
+        state->state = 1;
+    }
+
+    state->itemsPtr = buffer;
+
+    return [self fillBuffer:buffer count:bufferSize];
+}
+
+- (NSArray *)toArray {
+    NSMutableArray *array = [[NSMutableArray alloc] init];
+    for (id element in self) {
+        [array addObject:element];
+    }
+
+    return array;
+}
+
+@end
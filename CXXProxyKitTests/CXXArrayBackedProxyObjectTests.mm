@@ -8,6 +8,7 @@
 
 #import <XCTest/XCTest.h>
 #import <CXXProxyKit/CXXProxyKit.h>
+#import <objc/runtime.h>
 
 #import "CXXArrayOfProxies.h"
 #import "CXXExampleProxy.h"
@@ -49,4 +50,69 @@
     XCTAssertEqual(proxyArray.count, objs.size());
 }
 
+- (void)test_proxyArrayIsCreatedOnFirstAccess {
+    CXXArraryOfProxies *freshProxyArray = cxx::proxy_cast<CXXArraryOfProxies>(objs);
+    Ivar proxyArrayIvar = class_getInstanceVariable(CXXArraryOfProxies.class, "proxyArray");
+
+    XCTAssertNil(object_getIvar(freshProxyArray, proxyArrayIvar));
+
+    XCTAssertEqual(freshProxyArray.count, objs.size());
+    XCTAssertNotNil(object_getIvar(freshProxyArray, proxyArrayIvar));
+}
+
+- (void)test_proxyArrayIsCreatedOnceAcrossThreads {
+    auto initialLoadCount = CXXCountingArrayOfProxiesLoadCount();
+
+    CXXCountingArrayOfProxies *freshProxyArray = cxx::proxy_cast<CXXCountingArrayOfProxies>(objs);
+
+    XCTAssertEqual(CXXCountingArrayOfProxiesLoadCount() - initialLoadCount, 0);
+
+    dispatch_apply(64, DISPATCH_APPLY_AUTO, ^(size_t iteration) {
+        switch (iteration % 3) {
+            case 0:
+                (void)freshProxyArray.count;
+                break;
+            case 1:
+                (void)freshProxyArray[0];
+                break;
+            default:
+                for (CXXExampleProxy *proxy in freshProxyArray) {
+                    (void)proxy;
+                }
+        }
+    });
+
+    XCTAssertEqual(CXXCountingArrayOfProxiesLoadCount() - initialLoadCount, 1);
+}
+
+- (void)test_elementsAreNotCopied {
+    XCTAssertEqual(proxyArray[1].implementationPtr, &objs[1]);
+}
+
+- (void)test_nestedIteration {
+    std::vector<std::vector<cxx_example_object>> rows = {
+        {cxx_example_object{1}, cxx_example_object{2}},
+        {},
+        {cxx_example_object{3}}
+    };
+
+    CXXNestedArrayOfProxies *nestedProxyArray = cxx::proxy_cast<CXXNestedArrayOfProxies>(rows);
+
+    XCTAssertEqual(nestedProxyArray.count, rows.size());
+
+    int rowIndex = 0;
+    for (CXXNonOwningProxyArray<CXXExampleProxy *> *row in nestedProxyArray) {
+        XCTAssertEqual(row.count, rows[rowIndex].size());
+
+        int index = 0;
+        for (CXXExampleProxy *proxy in row) {
+            XCTAssertEqual(proxy.implementationPtr, &rows[rowIndex][index++]);
+        }
+
+        rowIndex++;
+    }
+
+    XCTAssertEqual(rowIndex, rows.size());
+}
+
 @end
@@ -9,6 +9,7 @@
 #import <XCTest/XCTest.h>
 #import <CXXProxyKit/CXXProxyKit.h>
 
+#import "CXXArrayOfProxies.h"
 #import "CXXExampleProxy.h"
 #import "cxx_example_object.h"
 
@@ -87,4 +88,51 @@
 
 }
 
+- (void)test_elementsAreNotCopied {
+    CXXNonOwningProxyArray<CXXExampleProxy *> *proxyArray = cxx::make_non_owning_proxy_array(vec, CXXExampleProxy.class);
+
+    XCTAssertEqual(proxyArray[0].implementationPtr, &vec[0]);
+
+    vec.push_back(cxx_example_object{3});
+
+    XCTAssertEqual(proxyArray.count, vec.size());
+    XCTAssertEqual(proxyArray[2].value, 3);
+}
+
+- (void)test_nestedNonOwningArray {
+    std::vector<std::vector<std::vector<cxx_example_object>>> matrices = {
+        {{cxx_example_object{1}}, {cxx_example_object{2}, cxx_example_object{3}}}
+    };
+
+    CXXNonOwningProxyArray *proxyArray = cxx::make_nested_non_owning_proxy_array<cxx_example_object>(matrices, CXXExampleProxy.class);
+
+    XCTAssertEqual(proxyArray.count, matrices.size());
+
+    CXXNonOwningProxyArray *matrix = proxyArray[0];
+    XCTAssertEqual(matrix.count, matrices[0].size());
+
+    CXXNonOwningProxyArray<CXXExampleProxy *> *row = matrix[1];
+    XCTAssertEqual(row.count, matrices[0][1].size());
+    XCTAssertEqual(row[1].value, 3);
+    XCTAssertEqual(row[1].implementationPtr, &matrices[0][1][1]);
+}
+
+- (void)test_nestedNonOwningArrayStopsAtContainerLeaf {
+    std::vector<std::vector<std::vector<cxx_example_object>>> matrices = {
+        {{cxx_example_object{1}}, {cxx_example_object{2}, cxx_example_object{3}}}
+    };
+
+    CXXNonOwningProxyArray *proxyArray =
+        cxx::make_nested_non_owning_proxy_array<std::vector<cxx_example_object>>(matrices, CXXArraryOfProxies.class);
+
+    CXXNonOwningProxyArray<CXXArraryOfProxies *> *matrix = proxyArray[0];
+    XCTAssertEqual(matrix.count, matrices[0].size());
+
+    CXXArraryOfProxies *row = matrix[1];
+    XCTAssertTrue([row isKindOfClass:CXXArraryOfProxies.class]);
+    XCTAssertEqual(row.implementationPtr, &matrices[0][1]);
+    XCTAssertEqual(row.count, matrices[0][1].size());
+    XCTAssertEqual(row[1].value, 3);
+}
+
 @end
@@ -3,3 +3,4 @@
 //
 
 #import "CXXArrayOfProxies.h"
+#import "CXXStreamOfProxies.h"
@@ -0,0 +1,38 @@
+//
+//  CXXProxyStreamSwift.swift
+//  CXXProxyKitTests
+//
+//  Created by Dmitry Khrykin on 22.09.2020.
+//  Copyright © 2020 Dmitry Khrykin. All rights reserved.
+//
+
+import XCTest
+import CXXProxyKit
+
+extension CXXStreamOfProxies : CXXProxyArraySequence {
+    public typealias Element = CXXExampleProxy
+}
+
+class CXXProxyStreamSwift: XCTestCase {
+
+    func test_iteration() throws {
+        var index = 0;
+        for proxy in CXXStreamOfProxiesMakeForTesting(100, 0) {
+            XCTAssertEqual(proxy.value, index)
+            index += 1
+        }
+
+        XCTAssertEqual(index, 100)
+    }
+
+    func test_prefetchingIteration() throws {
+        var index = 0;
+        for proxy in CXXStreamOfProxiesMakeForTesting(100, 8) {
+            XCTAssertEqual(proxy.value, index)
+            index += 1
+        }
+
+        XCTAssertEqual(index, 100)
+    }
+
+}
@@ -0,0 +1,171 @@
+//
+//  CXXProxyStreamTests.m
+//  CXXProxyKitTests
+//
+//  Created by Dmitry Khrykin on 22.09.2020.
+//  Copyright © 2020 Dmitry Khrykin. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <CXXProxyKit/CXXProxyKit.h>
+
+#import <atomic>
+#import <memory>
+#import <optional>
+#import <stdexcept>
+
+#import "CXXExampleProxy.h"
+#import "cxx_example_object.h"
+
+static auto make_counting_generator(int limit, std::shared_ptr<std::atomic<int>> calls = nullptr) {
+    return [limit, calls, next = 0] () mutable -> std::optional<cxx_example_object> {
+        if (calls) {
+            (*calls)++;
+        }
+
+        if (limit >= 0 && next >= limit) {
+            return std::nullopt;
+        }
+
+        return cxx_example_object{next++};
+    };
+}
+
+static auto make_failing_generator(int fail_index) {
+    return [fail_index, next = 0] () mutable -> std::optional<cxx_example_object> {
+        if (next == fail_index) {
+            throw std::runtime_error("generator failed");
+        }
+
+        return cxx_example_object{next++};
+    };
+}
+
+@interface CXXProxyStreamTests : XCTestCase
+
+@end
+
+@implementation CXXProxyStreamTests
+
+- (void)test_streamWithProxyClass {
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_counting_generator(100), CXXExampleProxy.class);
+
+    int index = 0;
+    for (CXXExampleProxy *proxy in stream) {
+        XCTAssertEqual(proxy.value, index++);
+    }
+
+    XCTAssertEqual(index, 100);
+}
+
+- (void)test_streamWithCustomAllocator {
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_counting_generator(2), [](cxx_example_object &&obj) {
+        return [[CXXExampleProxy alloc] initWithValue:obj.value * 10];
+    });
+
+    XCTAssertEqual(stream.nextObject.value, 0);
+    XCTAssertEqual(stream.nextObject.value, 10);
+    XCTAssertNil(stream.nextObject);
+}
+
+- (void)test_streamIsSinglePass {
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_counting_generator(3), CXXExampleProxy.class);
+
+    XCTAssertEqual(stream.nextObject.value, 0);
+
+    NSArray<CXXExampleProxy *> *rest = [stream toArray];
+
+    XCTAssertEqual(rest.count, 2);
+    XCTAssertEqual(rest[0].value, 1);
+    XCTAssertEqual([stream toArray].count, 0);
+}
+
+- (void)test_prefetchingStream {
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_counting_generator(1000), CXXExampleProxy.class, 16);
+
+    int index = 0;
+    for (CXXExampleProxy *proxy in stream) {
+        XCTAssertEqual(proxy.value, index++);
+    }
+
+    XCTAssertEqual(index, 1000);
+    XCTAssertNil(stream.nextObject);
+}
+
+- (void)test_prefetchingStaysWithinCapacity {
+    auto calls = std::make_shared<std::atomic<int>>(0);
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_counting_generator(-1, calls), CXXExampleProxy.class, 4);
+
+    XCTAssertEqual(stream.nextObject.value, 0);
+
+    // One consumed element, a full buffer and one element waiting for a free slot.
+    auto expectedCalls = 1 + 4 + 1;
+
+    auto *timeout = [NSDate dateWithTimeIntervalSinceNow:2];
+    while (calls->load() < expectedCalls && timeout.timeIntervalSinceNow > 0) {
+        [NSThread sleepForTimeInterval:0.01];
+    }
+
+    XCTAssertEqual(calls->load(), expectedCalls);
+
+    [NSThread sleepForTimeInterval:0.1];
+
+    XCTAssertEqual(calls->load(), expectedCalls);
+}
+
+- (void)test_rethrowsGeneratorExceptionAfterProducedElements {
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_failing_generator(2), CXXExampleProxy.class);
+
+    [self assertEnumeratesTwoElementsAndRethrows:stream];
+}
+
+- (void)test_prefetchingRethrowsGeneratorExceptionAfterProducedElements {
+    CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(make_failing_generator(2), CXXExampleProxy.class, 4);
+
+    [self assertEnumeratesTwoElementsAndRethrows:stream];
+}
+
+- (void)assertEnumeratesTwoElementsAndRethrows:(CXXProxyStream<CXXExampleProxy *> *)stream {
+    int index = 0;
+    bool didThrow = false;
+
+    // The fast enumeration buffer is larger than the index of the failure,
+    // so the elements produced before it must not be lost with the exception.
+    try {
+        for (CXXExampleProxy *proxy in stream) {
+            XCTAssertEqual(proxy.value, index++);
+        }
+    } catch (const std::runtime_error &) {
+        didThrow = true;
+    }
+
+    XCTAssertEqual(index, 2);
+    XCTAssertTrue(didThrow);
+    XCTAssertNil(stream.nextObject);
+}
+
+- (void)test_prefetchingStopsAfterStreamIsDeallocated {
+    std::weak_ptr<int> weakSentinel;
+
+    @autoreleasepool {
+        auto sentinel = std::make_shared<int>(0);
+        weakSentinel = sentinel;
+
+        // The sentinel is released only when the producer thread returns and releases the generator.
+        auto generator = [sentinel] () -> std::optional<cxx_example_object> {
+            return cxx_example_object{*sentinel};
+        };
+
+        CXXProxyStream<CXXExampleProxy *> *stream = cxx::make_proxy_stream(generator, CXXExampleProxy.class, 4);
+        (void)stream.nextObject;
+    }
+
+    auto *timeout = [NSDate dateWithTimeIntervalSinceNow:2];
+    while (!weakSentinel.expired() && timeout.timeIntervalSinceNow > 0) {
+        [NSThread sleepForTimeInterval:0.01];
+    }
+
+    XCTAssertTrue(weakSentinel.expired());
+}
+
+@end
@@ -16,11 +16,23 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+/**
+ Counts how many times its backing proxy array is created.
+ */
+@interface CXXCountingArrayOfProxies : NSObject <CXXArrayBackedProxyObject> CXX_PROXY_ARRAY_OF(CXXExampleProxy)
+
+@end
+
+@interface CXXNestedArrayOfProxies : NSObject <CXXArrayBackedProxyObject> CXX_PROXY_ARRAY_OF(CXXNonOwningProxyArray)
+
+@end
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 CXXArraryOfProxies *CXXArraryOfProxiesMakeForTesting(void);
+NSInteger CXXCountingArrayOfProxiesLoadCount(void);
 
 #ifdef __cplusplus
 }
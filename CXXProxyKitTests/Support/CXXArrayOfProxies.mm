@@ -6,6 +6,7 @@
 //  Copyright © 2020 Dmitry Khrykin. All rights reserved.
 //
 
+#import <atomic>
 #import <vector>
 #import "CXXArrayOfProxies.h"
 #import "cxx_example_object.h"
@@ -14,11 +15,42 @@
 
 @end
 
+static std::atomic<NSInteger> countingArrayOfProxiesLoadCount{0};
+
+static CXXNonOwningProxyArray *make_counted_proxy_array(const std::vector<cxx_example_object> &objects) {
+    countingArrayOfProxiesLoadCount++;
+
+    // Widens the window in which concurrent first accesses could race.
+    [NSThread sleepForTimeInterval:0.01];
+
+    return cxx::make_non_owning_proxy_array(objects, CXXExampleProxy.class);
+}
+
+@implementation CXX_ARRAY_BACKED_PROXY_OBJECT_IMPL(CXXCountingArrayOfProxies,
+                                                   CXXExampleProxy *,
+                                                   std::vector<cxx_example_object>,
+                                                   objects,
+                                                   make_counted_proxy_array(*objects))
+
+@end
+
+@implementation CXX_NESTED_ARRAY_BACKED_PROXY_OBJECT(CXXNestedArrayOfProxies,
+                                                     CXXExampleProxy,
+                                                     cxx_example_object,
+                                                     std::vector<std::vector<cxx_example_object>>,
+                                                     rows)
+
+@end
+
 CXXArraryOfProxies *CXXArraryOfProxiesMakeForTesting(void) {
-    std::vector<cxx_example_object> objs = {
+    auto *objs = new std::vector<cxx_example_object>{
         cxx_example_object{0},
         cxx_example_object{1}
     };
 
-    return cxx::proxy_cast<CXXArraryOfProxies>(objs);
+    return [[CXXArraryOfProxies alloc] initWithOwnedPtr:objs];
+}
+
+NSInteger CXXCountingArrayOfProxiesLoadCount(void) {
+    return countingArrayOfProxiesLoadCount;
 }
@@ -0,0 +1,29 @@
+//
+//  CXXStreamOfProxies.h
+//  CXXProxyKitTests
+//
+//  Created by Dmitry Khrykin on 22.09.2020.
+//  Copyright © 2020 Dmitry Khrykin. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "CXXExampleProxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CXXStreamOfProxies : CXXProxyStream<CXXExampleProxy *>
+
+@end
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+CXXStreamOfProxies *CXXStreamOfProxiesMakeForTesting(NSInteger count, NSUInteger prefetchCapacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+NS_ASSUME_NONNULL_END
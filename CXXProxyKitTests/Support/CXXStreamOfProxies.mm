@@ -0,0 +1,27 @@
+//
+//  CXXStreamOfProxies.m
+//  CXXProxyKitTests
+//
+//  Created by Dmitry Khrykin on 22.09.2020.
+//  Copyright © 2020 Dmitry Khrykin. All rights reserved.
+//
+
+#import <optional>
+#import "CXXStreamOfProxies.h"
+#import "cxx_example_object.h"
+
+@implementation CXXStreamOfProxies
+
+@end
+
+CXXStreamOfProxies *CXXStreamOfProxiesMakeForTesting(NSInteger count, NSUInteger prefetchCapacity) {
+    auto generator = [count, next = 0] () mutable -> std::optional<cxx_example_object> {
+        if (next >= count) {
+            return std::nullopt;
+        }
+
+        return cxx_example_object{next++};
+    };
+
+    return cxx::make_proxy_stream<CXXStreamOfProxies>(generator, CXXExampleProxy.class, prefetchCapacity);
+}